@@ -0,0 +1,45 @@
+// Compile-time benchmark: instantiates the nullsafety templates for many distinct pointer types,
+// so that the front-end cost of the header (or the hng.nullsafety module) can be tracked.
+// Build the nullsafety_bench_compile_time target and compare the compile time of this file.
+#include <cstddef>
+#include <memory>
+#include <utility>
+#ifdef HNG_NULLSAFETY_BENCH_IMPORT_MODULE
+import hng.nullsafety;
+#else
+#include <hng/nullsafety/nullsafety.h>
+#endif
+
+#ifndef HNG_NULLSAFETY_BENCH_TYPE_COUNT
+#define HNG_NULLSAFETY_BENCH_TYPE_COUNT 400
+#endif
+
+namespace hng {
+    namespace nullsafety_bench {
+        template<std::size_t I>
+        struct Tag {
+            int value = static_cast<int>(I);
+        };
+
+        template<std::size_t I>
+        int use() {
+            Tag<I> tag;
+            hng::nullsafety::notnull<Tag<I>*> p(&tag);
+            hng::nullsafety::notnull<Tag<I>*> q = std::move(p);
+            hng::nullsafety::derefnullchecked<Tag<I>*> d(q);
+            hng::nullsafety::notnull<std::shared_ptr<Tag<I>>> s = std::make_shared<Tag<I>>();
+            hng::nullsafety::notnull<std::unique_ptr<Tag<I>>> u = std::make_unique<Tag<I>>();
+            hng::nullsafety::notnull_box<Tag<I>> b(std::in_place);
+            return q->value + d->value + s->value + u->value + b->value;
+        }
+
+        template<std::size_t...I>
+        int use_all(std::index_sequence<I...>) {
+            return (use<I>() + ...);
+        }
+    }
+}
+
+int main() {
+    return hng::nullsafety_bench::use_all(std::make_index_sequence<HNG_NULLSAFETY_BENCH_TYPE_COUNT>{}) == 0 ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <hng/nullsafety/lazy_notnull.h>
+
+// Contended-access benchmark: several threads start at the same time against an uninitialized value
+// and then keep reading it. Compares lazy_notnull with the derefnullchecked + std::call_once pattern it replaces.
+namespace hng {
+    namespace nullsafety_bench {
+
+        struct Table {
+            std::int64_t values[16]{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+        };
+
+        class CallOnceTable {
+        private:
+            mutable std::once_flag m_once;
+            mutable hng::nullsafety::derefnullchecked<std::unique_ptr<Table>> m_value;
+        public:
+            Table const& get() const {
+                std::call_once(m_once, [this] { m_value = std::make_unique<Table>(); });
+                return *m_value;
+            }
+        };
+
+        template<class Source>
+        double run(Source const& source, unsigned threadCount, std::int64_t iterations) {
+            std::atomic<bool> start = false;
+            std::atomic<std::int64_t> checksum = 0;
+            std::vector<std::thread> threads;
+            for (unsigned t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&, t] {
+                    while (!start.load(std::memory_order_acquire)) {}
+                    std::int64_t sum = 0;
+                    for (std::int64_t i = 0; i < iterations; ++i) {
+                        sum += (*source.get()).values[(i + t) & 15];
+                    }
+                    checksum.fetch_add(sum, std::memory_order_relaxed);
+                    });
+            }
+            auto const begin = std::chrono::steady_clock::now();
+            start.store(true, std::memory_order_release);
+            for (auto& thread : threads) thread.join();
+            auto const end = std::chrono::steady_clock::now();
+            if (checksum.load() == 0) std::cout << "unexpected checksum" << std::endl;
+            return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(iterations);
+        }
+
+        struct LazyTableSource {
+            hng::nullsafety::lazy_notnull<std::unique_ptr<Table>, std::unique_ptr<Table>(*)()> lazy{ [] { return std::make_unique<Table>(); } };
+            hng::nullsafety::notnull<std::unique_ptr<Table>> const& get() const { return lazy.get(); }
+        };
+        struct CallOnceTableSource {
+            CallOnceTable table;
+            Table const* get() const { return &table.get(); }
+        };
+
+        void report(std::string_view name, unsigned threadCount, double nsPerIteration) {
+            std::cout << name << "\tthreads=" << threadCount << "\t" << nsPerIteration << " ns/iteration (wall clock)" << std::endl;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace hng::nullsafety_bench;
+    std::int64_t const iterations = argc > 1 ? std::stoll(argv[1]) : 20'000'000;
+    unsigned const maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        {
+            LazyTableSource source;
+            report("lazy_notnull", threadCount, run(source, threadCount, iterations));
+        }
+        {
+            CallOnceTableSource source;
+            report("call_once+derefnullchecked", threadCount, run(source, threadCount, iterations));
+        }
+    }
+}
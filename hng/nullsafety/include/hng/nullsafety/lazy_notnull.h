@@ -0,0 +1,72 @@
+#ifndef HNG_NULLSAFETY_LAZY_NOTNULL_HEADERGUARD
+#define HNG_NULLSAFETY_LAZY_NOTNULL_HEADERGUARD
+//
+//	Author:		Elijah Shadbolt
+//	Licence:	MIT
+//	GitHub:		https://github.com/highestnamegames/nullsafety
+//	Version:	v1.0.1
+//
+//	Summary:
+//		Thread safe lazily initialized notnull.
+//		Kept out of nullsafety.h so that only users of lazy_notnull include <atomic> and <mutex> and link a thread library.
+//
+
+#include "nullsafety.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace hng {
+    namespace nullsafety {
+        // The lazy_notnull class holds a notnull<P> that is created by calling the factory on first access.
+        // Once initialized, accessing the value is a single acquire load. Under contention the factory is called at most once
+        // at a time, and only until it succeeds. If the factory returns null (falsy) then get() throws nullptr_error,
+        // the lazy_notnull stays uninitialized and the next access calls the factory again.
+        // If Factory is a function pointer, it is not default constructible, and get() throws nullptr_error if it is null.
+        template<class P, class Factory>
+            requires (!std::is_reference_v<P> && !std::is_volatile_v<P> && !std::is_const_v<P>)
+            && std::invocable<Factory&> && std::constructible_from<P, std::invoke_result_t<Factory&>>
+        class lazy_notnull {
+            private:
+                mutable std::atomic<notnull<P> const*> m_value{ nullptr };
+                mutable std::mutex m_mutex;
+                HNG_NULLSAFETY_NO_UNIQUE_ADDRESS mutable Factory m_factory;
+                alignas(notnull<P>) mutable std::byte m_storage[sizeof(notnull<P>)];
+
+                notnull<P> const& initialize() const {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (auto value = m_value.load(std::memory_order_relaxed)) return *value;
+                    if constexpr (std::is_pointer_v<Factory>) {
+                        if (!m_factory) throw nullptr_error();
+                    }
+                    auto value = ::new (static_cast<void*>(m_storage)) notnull<P>(P(std::invoke(m_factory)));
+                    m_value.store(value, std::memory_order_release);
+                    return *value;
+                }
+            public:
+                inline ~lazy_notnull() noexcept(std::is_nothrow_destructible_v<P>) {
+                    if (auto value = m_value.load(std::memory_order_acquire)) value->~notnull<P>();
+                }
+                inline lazy_notnull() noexcept(std::is_nothrow_default_constructible_v<Factory>) requires std::is_default_constructible_v<Factory> && (!std::is_pointer_v<Factory>) : m_factory() {}
+                inline explicit lazy_notnull(Factory factory) noexcept(std::is_nothrow_move_constructible_v<Factory>) : m_factory(std::move(factory)) {}
+                lazy_notnull(lazy_notnull const&) = delete;
+                lazy_notnull& operator=(lazy_notnull const&) = delete;
+
+                inline bool is_initialized() const noexcept { return m_value.load(std::memory_order_acquire) != nullptr; }
+
+                // returns the value, calling the factory first if it has not been initialized yet.
+                // throws nullptr_error if the factory returns null (falsy).
+                inline notnull<P> const& get() const {
+                    if (auto value = m_value.load(std::memory_order_acquire)) [[likely]] return *value;
+                    return initialize();
+                }
+                inline /*implicit*/ operator notnull<P> const& () const { return get(); }
+                inline decltype(auto) operator*() const { return *get(); }
+                inline auto const& operator->() const { return get().ptr(); }
+        };
+
+        template<class Factory> lazy_notnull(Factory) -> lazy_notnull<std::remove_cvref_t<std::invoke_result_t<Factory&>>, Factory>;
+    }
+}
+
+#endif //~ HNG_NULLSAFETY_LAZY_NOTNULL_HEADERGUARD
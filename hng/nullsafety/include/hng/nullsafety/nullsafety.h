@@ -8,15 +8,26 @@
 //	Version:	v1.0.1
 //
 //	Summary:
-//		C++ header only library for null safety utilities, including notnull and derefnullchecked.
+//		C++ header only library for null safety utilities, including notnull, derefnullchecked and notnull_box.
 //
 
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <concepts>
+#include <utility>
+#include <new>
+#include <cstddef>
 #include <span>
 #include <algorithm>
 
+// Expands to the attribute that lets an empty member (such as notnull_constant) take no space.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define HNG_NULLSAFETY_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define HNG_NULLSAFETY_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 namespace hng {
     namespace nullsafety {
         class nullptr_error : public std::runtime_error
@@ -29,9 +40,30 @@ namespace hng {
             struct private_unsafe_notnull_from_nullable_t {};
             inline constexpr private_unsafe_notnull_from_nullable_t const private_unsafe_notnull_from_nullable{};
 
-            template<class Lambda, int = (Lambda{}(), 0) >
+            template<class Lambda, int = (static_cast<void>(Lambda{}()), 0) >
             inline constexpr bool is_constexpr(Lambda) { return true; }
             inline constexpr bool is_constexpr(...) { return false; }
+
+            // true if P() is a constant expression that is truthy, in which case notnull<P> can be moved by swapping with P().
+            // Evaluated once per P, instead of once per constraint of each notnull<P> move constructor.
+            template<class P>
+            inline constexpr bool const is_truthy_when_default_constructed_v = []() {
+                if constexpr (std::is_default_constructible_v<P>) {
+                    return is_constexpr([] { return static_cast<bool>(P()); }) && static_cast<bool>(P());
+                }
+                else {
+                    return false;
+                }
+                }();
+
+            // true if no element of the span is null (falsy).
+            template<class P, size_t E>
+            inline constexpr bool none_null(std::span<P, E> const& span) {
+                for (auto const& ptr : span) {
+                    if (!ptr) return false;
+                }
+                return true;
+            }
         }
 
         template<class P> requires (!std::is_reference_v<P> && !std::is_volatile_v<P> && !std::is_const_v<P>)
@@ -77,14 +109,14 @@ namespace hng {
                 }
                 inline constexpr notnull(notnull const&) noexcept(std::is_nothrow_copy_constructible_v<P>) = default;
                 inline constexpr notnull(notnull&& other) noexcept(std::is_nothrow_default_constructible_v<P>&& std::is_nothrow_swappable_v<P>)
-                    requires std::is_default_constructible_v<P> && (detail::is_constexpr([] { static_cast<bool>(P()); }) && static_cast<bool>(P()))
+                    requires detail::is_truthy_when_default_constructed_v<P>
                 : m_ptr()
                 {
                     using std::swap;
                     swap(m_ptr, other.m_ptr);
                 }
                 inline constexpr notnull(notnull&& other) noexcept(std::is_nothrow_copy_constructible_v<P>)
-                    requires !(std::is_default_constructible_v<P> && (detail::is_constexpr([] { static_cast<bool>(P()); }) && static_cast<bool>(P())))
+                    requires (!detail::is_truthy_when_default_constructed_v<P>)
                 : notnull(std::as_const(other))
                 {
                 }
@@ -222,19 +254,19 @@ namespace hng {
                     return !m_ptr;
                 }
                 inline constexpr decltype(auto) operator*() const {
-                    if (!operator bool()) throw nullptr_error();
+                    if (!static_cast<bool>(m_ptr)) throw nullptr_error();
                     return *m_ptr;
                 }
                 inline constexpr decltype(auto) operator*() {
-                    if (!operator bool()) throw nullptr_error();
+                    if (!static_cast<bool>(m_ptr)) throw nullptr_error();
                     return *m_ptr;
                 }
                 inline constexpr auto const& operator->() const {
-                    if (!operator bool()) throw nullptr_error();
+                    if (!static_cast<bool>(m_ptr)) throw nullptr_error();
                     return m_ptr;
                 }
                 inline constexpr auto& operator->() {
-                    if (!operator bool()) throw nullptr_error();
+                    if (!static_cast<bool>(m_ptr)) throw nullptr_error();
                     return m_ptr;
                 }
                 //inline constexpr auto operator<=>(derefnullchecked const&) const = default;
@@ -259,6 +291,71 @@ namespace hng {
             swap(lhs, rhs.ptr());
         }
 
+        // The notnull_constant class is an empty type for a non-null pointer that is known at compile time,
+        // such as the address of a global singleton or static table. It takes no space as a HNG_NULLSAFETY_NO_UNIQUE_ADDRESS member,
+        // and converts to notnull<P> and derefnullchecked<P>.
+        template<auto Ptr> requires std::is_pointer_v<decltype(Ptr)>
+        class notnull_constant {
+            public:
+                using pointer = decltype(Ptr);
+                static_assert(Ptr != nullptr, "notnull_constant pointer must not be null");
+                static constexpr pointer const value = Ptr;
+
+                inline constexpr pointer ptr() const noexcept { return Ptr; }
+                inline constexpr /*implicit*/ operator pointer() const noexcept { return Ptr; }
+                inline constexpr /*implicit*/ operator notnull<pointer>() const noexcept {
+                    return notnull<pointer>(detail::private_unsafe_notnull_from_nullable, Ptr);
+                }
+                inline constexpr /*implicit*/ operator derefnullchecked<pointer>() const noexcept { return derefnullchecked<pointer>(Ptr); }
+                inline constexpr explicit operator bool() const noexcept { return true; }
+                inline constexpr bool operator!() const noexcept { return false; }
+                inline constexpr decltype(auto) operator*() const noexcept { return *Ptr; }
+                inline constexpr pointer operator->() const noexcept { return Ptr; }
+        };
+
+        // Handle traits define the invalid (sentinel) value of a handle type through a static invalid() function,
+        // for example -1 for a file descriptor, where 0 is a valid value.
+        template<class Traits, class T>
+        concept handle_traits = requires { { Traits::invalid() } -> std::convertible_to<T>; };
+
+        // Handle traits for a sentinel value that is a constant expression.
+        template<class T, T Invalid>
+        struct sentinel_handle_traits {
+            static inline constexpr T invalid() noexcept { return Invalid; }
+        };
+
+        // The notnull_handle class invariant guarantees that the inner value is not equal to Traits::invalid().
+        // Unlike notnull<T>, which treats falsy values as invalid, the invalid value is defined by Traits.
+        // notnull_handle does not own the handle; see posix_handles.h for owning wrappers.
+        template<class T, class Traits> requires (!std::is_reference_v<T> && !std::is_volatile_v<T> && !std::is_const_v<T>)
+            && handle_traits<Traits, T>
+        class notnull_handle {
+            private:
+                T m_value;
+            public:
+                using traits_type = Traits;
+
+                static inline constexpr bool is_valid(T const& value) { return !(value == Traits::invalid()); }
+
+                inline constexpr /*implicit*/ notnull_handle(T const& value) : m_value([&value]() -> T const& {
+                    if (!is_valid(value)) throw nullptr_error();
+                    return value;
+                    }())
+                {
+                }
+                inline constexpr notnull_handle(notnull_handle const&) noexcept(std::is_nothrow_copy_constructible_v<T>) = default;
+                inline constexpr notnull_handle& operator=(notnull_handle const&) noexcept(std::is_nothrow_copy_assignable_v<T>) = default;
+                inline constexpr notnull_handle& operator=(T const& value) {
+                    if (!is_valid(value)) throw nullptr_error();
+                    m_value = value;
+                    return *this;
+                }
+                inline constexpr T const& get() const noexcept { return m_value; }
+                inline constexpr /*implicit*/ operator T const& () const noexcept { return m_value; }
+                inline constexpr explicit operator bool() const noexcept { return true; }
+                inline constexpr bool operator!() const noexcept { return false; }
+        };
+
         // returns the pointer unchanged, or throws nullptr_error if the pointer is null (falsy).
         template<class P> inline constexpr decltype(auto) throw_if_null(P&& ptr) { if (!ptr) throw nullptr_error(); return std::forward<P>(ptr); }
 
@@ -275,7 +372,7 @@ namespace hng {
             requires (sizeof(P) == sizeof(notnull<P>)) && (alignof(P) == alignof(notnull<P>))
         && (!std::is_volatile_v<P>)
         {
-            if (std::all_of(std::cbegin(span), std::cend(span), std::identity{})) {
+            if (detail::none_null(span)) {
                 return std::span<notnull<P>, E>(reinterpret_cast<notnull<P>*>(span.data()), span.size());
             }
             throw nullptr_error();
@@ -285,7 +382,7 @@ namespace hng {
             requires (sizeof(P const) == sizeof(notnull<P> const)) && (alignof(P const) == alignof(notnull<P> const))
         && (!std::is_volatile_v<P>)
         {
-            if (std::all_of(std::cbegin(span), std::cend(span), std::identity{})) {
+            if (detail::none_null(span)) {
                 return std::span<notnull<P> const, E>(reinterpret_cast<notnull<P> const*>(span.data()), span.size());
             }
             throw nullptr_error();
@@ -316,6 +413,150 @@ namespace hng {
             return span;
         }
 
+        namespace detail {
+            template<class T>
+            struct notnull_box_ops {
+                void (*destroy)(T* ptr) noexcept;
+                // Moves the object out of ptr (whose storage is src) into dst if it is stored inline,
+                // otherwise transfers ownership of the heap allocation. Returns the new pointer.
+                T* (*relocate)(T* ptr, void* dst) noexcept;
+                bool is_inline;
+            };
+
+            template<class U, class T>
+            concept notnull_box_storable = (std::same_as<U, T> || std::derived_from<U, T>) && std::is_object_v<U> && (!std::is_abstract_v<U>);
+
+            template<class T, class U>
+            inline constexpr notnull_box_ops<T> const notnull_box_inline_ops{
+                [](T* ptr) noexcept { static_cast<U*>(ptr)->~U(); },
+                [](T* ptr, void* dst) noexcept -> T* {
+                    U* src = static_cast<U*>(ptr);
+                    U* moved = ::new (dst) U(std::move(*src));
+                    src->~U();
+                    return moved;
+                },
+                true,
+            };
+
+            template<class T, class U>
+            inline constexpr notnull_box_ops<T> const notnull_box_heap_ops{
+                [](T* ptr) noexcept { delete static_cast<U*>(ptr); },
+                [](T* ptr, void*) noexcept -> T* { return ptr; },
+                false,
+            };
+        }
+
+        // The notnull_box class owns an object of type T (or a type derived from T) and is never null while it holds it.
+        // Objects that fit in InlineBytes and are nothrow move constructible are stored inline (no heap allocation),
+        // larger objects are allocated on the heap. Dereferencing does not check for null.
+        // Unlike notnull<std::unique_ptr<T>>, notnull_box is move constructible. A moved-from notnull_box is valueless:
+        // it converts to false and as_notnull() throws nullptr_error, but dereferencing it is undefined behaviour,
+        // so it is the programmer's responsibility to only destroy it or assign it a new value (see valueless_after_move()).
+        template<class T, std::size_t InlineBytes = 2 * sizeof(void*)>
+            requires (std::is_object_v<T> && !std::is_array_v<T> && !std::is_volatile_v<T> && !std::is_const_v<T>)
+        class notnull_box {
+            private:
+                template<class U>
+                static constexpr bool const stores_inline = sizeof(U) <= InlineBytes
+                    && alignof(U) <= alignof(std::max_align_t)
+                    && std::is_nothrow_move_constructible_v<U>;
+
+                alignas(std::max_align_t) std::byte m_storage[InlineBytes > 0 ? InlineBytes : 1];
+                T* m_ptr = nullptr;
+                detail::notnull_box_ops<T> const* m_ops = nullptr;
+
+                inline void reset() noexcept {
+                    if (m_ops) m_ops->destroy(m_ptr);
+                    m_ptr = nullptr;
+                    m_ops = nullptr;
+                }
+                inline void take(notnull_box& other) noexcept {
+                    if (other.m_ops) m_ptr = other.m_ops->relocate(other.m_ptr, m_storage);
+                    m_ops = std::exchange(other.m_ops, nullptr);
+                    other.m_ptr = nullptr;
+                }
+            public:
+                using element_type = T;
+
+                inline ~notnull_box() noexcept { reset(); }
+                template<class U, class...CArgs>
+                    requires detail::notnull_box_storable<U, T> && std::constructible_from<U, CArgs&&...>
+                inline explicit notnull_box(std::in_place_type_t<U>, CArgs&&...args) {
+                    if constexpr (stores_inline<U>) {
+                        m_ptr = ::new (static_cast<void*>(m_storage)) U(std::forward<CArgs>(args)...);
+                        m_ops = &detail::notnull_box_inline_ops<T, U>;
+                    }
+                    else {
+                        m_ptr = new U(std::forward<CArgs>(args)...);
+                        m_ops = &detail::notnull_box_heap_ops<T, U>;
+                    }
+                }
+                template<class...CArgs> requires detail::notnull_box_storable<T, T> && std::constructible_from<T, CArgs&&...>
+                inline explicit notnull_box(std::in_place_t, CArgs&&...args)
+                    : notnull_box(std::in_place_type<T>, std::forward<CArgs>(args)...)
+                {
+                }
+                template<class U> requires (!std::same_as<std::remove_cvref_t<U>, notnull_box>) && detail::notnull_box_storable<std::remove_cvref_t<U>, T>
+                inline /*implicit*/ notnull_box(U&& value)
+                    : notnull_box(std::in_place_type<std::remove_cvref_t<U>>, std::forward<U>(value))
+                {
+                }
+                inline notnull_box() requires detail::notnull_box_storable<T, T> && std::is_default_constructible_v<T>
+                    : notnull_box(std::in_place_type<T>)
+                {
+                }
+                notnull_box(notnull_box const&) = delete;
+                notnull_box& operator=(notnull_box const&) = delete;
+                notnull_box(std::nullptr_t) = delete;
+                notnull_box& operator=(std::nullptr_t) = delete;
+                inline notnull_box(notnull_box&& other) noexcept {
+                    take(other);
+                }
+                inline notnull_box& operator=(notnull_box&& other) noexcept {
+                    if (this != &other) {
+                        // take ownership before destroying the current object, because other may be owned by it.
+                        notnull_box tmp(std::move(other));
+                        reset();
+                        take(tmp);
+                    }
+                    return *this;
+                }
+                inline void swap(notnull_box& other) noexcept {
+                    notnull_box tmp(std::move(other));
+                    other = std::move(*this);
+                    *this = std::move(tmp);
+                }
+
+                // Returns true if the object is stored inside the notnull_box rather than on the heap.
+                inline bool is_inline() const noexcept { return m_ops && m_ops->is_inline; }
+                // Returns true only if this notnull_box has been moved from and not yet assigned a new value.
+                inline bool valueless_after_move() const noexcept { return !m_ops; }
+
+                inline T* get() noexcept { return m_ptr; }
+                inline T const* get() const noexcept { return m_ptr; }
+                // throws nullptr_error if this notnull_box is valueless after move.
+                inline notnull<T*> as_notnull() { return notnull<T*>(m_ptr); }
+                // throws nullptr_error if this notnull_box is valueless after move.
+                inline notnull<T const*> as_notnull() const { return notnull<T const*>(static_cast<T const*>(m_ptr)); }
+                inline explicit operator bool() const noexcept { return m_ops != nullptr; }
+                inline bool operator!() const noexcept { return m_ops == nullptr; }
+                inline T& operator*() noexcept { return *m_ptr; }
+                inline T const& operator*() const noexcept { return *m_ptr; }
+                inline T* operator->() noexcept { return m_ptr; }
+                inline T const* operator->() const noexcept { return m_ptr; }
+        };
+
+        template<class T, std::size_t InlineBytes>
+        inline void swap(notnull_box<T, InlineBytes>& lhs, notnull_box<T, InlineBytes>& rhs) noexcept {
+            lhs.swap(rhs);
+        }
+
+        // Constructs a notnull_box<T, InlineBytes> holding a U constructed from args. U must be T or derived from T.
+        template<class T, class U = T, std::size_t InlineBytes = 2 * sizeof(void*), class...CArgs>
+        inline notnull_box<T, InlineBytes> make_notnull_box(CArgs&&...args) {
+            return notnull_box<T, InlineBytes>(std::in_place_type<U>, std::forward<CArgs>(args)...);
+        }
+
     }
 }
 
@@ -0,0 +1,128 @@
+#ifndef HNG_NULLSAFETY_POSIX_HANDLES_HEADERGUARD
+#define HNG_NULLSAFETY_POSIX_HANDLES_HEADERGUARD
+//
+//	Author:		Elijah Shadbolt
+//	Licence:	MIT
+//	GitHub:		https://github.com/highestnamegames/nullsafety
+//	Version:	v1.0.1
+//
+//	Summary:
+//		POSIX file descriptor and memory mapped region wrappers built on notnull_handle.
+//		Only include this header on POSIX platforms.
+//
+
+#include "nullsafety.h"
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace hng {
+    namespace nullsafety {
+        // A file descriptor is invalid if it is -1. 0 is a valid file descriptor (stdin).
+        using fd_traits = sentinel_handle_traits<int, -1>;
+        using notnull_fd = notnull_handle<int, fd_traits>;
+
+        // A mapped address is invalid if it is MAP_FAILED. MAP_FAILED is not a constant expression.
+        struct mmap_traits {
+            static inline void* invalid() noexcept { return MAP_FAILED; }
+        };
+        using notnull_mmap = notnull_handle<void*, mmap_traits>;
+
+        // The unique_fd class owns a file descriptor and closes it in the destructor.
+        // It is nullable: a default constructed or moved-from unique_fd is empty, and get() throws nullptr_error if it is empty.
+        class unique_fd {
+            private:
+                int m_fd = fd_traits::invalid();
+            public:
+                inline ~unique_fd() noexcept { reset(); }
+                inline unique_fd() noexcept = default;
+                inline explicit unique_fd(notnull_fd fd) noexcept : m_fd(fd) {}
+                inline unique_fd(unique_fd&& other) noexcept : m_fd(std::exchange(other.m_fd, fd_traits::invalid())) {}
+                inline unique_fd& operator=(unique_fd&& other) noexcept {
+                    if (this != &other) {
+                        reset();
+                        m_fd = std::exchange(other.m_fd, fd_traits::invalid());
+                    }
+                    return *this;
+                }
+                unique_fd(unique_fd const&) = delete;
+                unique_fd& operator=(unique_fd const&) = delete;
+
+                // opens the file, or throws std::system_error if ::open fails.
+                static inline unique_fd open(char const* path, int flags, mode_t mode = 0) {
+                    int fd = ::open(path, flags, mode);
+                    if (!notnull_fd::is_valid(fd)) throw std::system_error(errno, std::generic_category(), "open");
+                    return unique_fd(notnull_fd(fd));
+                }
+
+                inline void reset() noexcept {
+                    if (notnull_fd::is_valid(m_fd)) ::close(std::exchange(m_fd, fd_traits::invalid()));
+                }
+                // After release() has returned, the caller is responsible for closing the file descriptor.
+                inline notnull_fd release() {
+                    notnull_fd fd = m_fd;
+                    m_fd = fd_traits::invalid();
+                    return fd;
+                }
+                inline notnull_fd get() const { return m_fd; }
+                inline explicit operator bool() const noexcept { return notnull_fd::is_valid(m_fd); }
+                inline bool operator!() const noexcept { return !notnull_fd::is_valid(m_fd); }
+        };
+
+        // The mapped_region class owns a memory mapping and unmaps it in the destructor.
+        // It is nullable: a default constructed or moved-from mapped_region is empty, and bytes() throws nullptr_error if it is empty.
+        class mapped_region {
+            private:
+                void* m_addr = mmap_traits::invalid();
+                std::size_t m_length = 0;
+            public:
+                inline ~mapped_region() noexcept { reset(); }
+                inline mapped_region() noexcept = default;
+                inline mapped_region(notnull_mmap addr, std::size_t length) noexcept : m_addr(addr), m_length(length) {}
+                inline mapped_region(mapped_region&& other) noexcept
+                    : m_addr(std::exchange(other.m_addr, mmap_traits::invalid()))
+                    , m_length(std::exchange(other.m_length, 0))
+                {
+                }
+                inline mapped_region& operator=(mapped_region&& other) noexcept {
+                    if (this != &other) {
+                        reset();
+                        m_addr = std::exchange(other.m_addr, mmap_traits::invalid());
+                        m_length = std::exchange(other.m_length, 0);
+                    }
+                    return *this;
+                }
+                mapped_region(mapped_region const&) = delete;
+                mapped_region& operator=(mapped_region const&) = delete;
+
+                // maps length bytes of the file, or throws std::system_error if ::mmap fails.
+                static inline mapped_region map(notnull_fd fd, std::size_t length, int prot = PROT_READ, int flags = MAP_SHARED, off_t offset = 0) {
+                    void* addr = ::mmap(nullptr, length, prot, flags, fd, offset);
+                    if (!notnull_mmap::is_valid(addr)) throw std::system_error(errno, std::generic_category(), "mmap");
+                    return mapped_region(notnull_mmap(addr), length);
+                }
+
+                inline void reset() noexcept {
+                    if (notnull_mmap::is_valid(m_addr)) ::munmap(std::exchange(m_addr, mmap_traits::invalid()), std::exchange(m_length, 0));
+                }
+                inline notnull_mmap get() const { return m_addr; }
+                inline std::size_t size() const noexcept { return m_length; }
+                // returns the mapped bytes, or throws nullptr_error if the mapped_region is empty.
+                // Only write through the span if the region was mapped with PROT_WRITE.
+                inline std::span<std::byte> bytes() {
+                    return std::span<std::byte>(static_cast<std::byte*>(get().get()), m_length);
+                }
+                // returns the mapped bytes, or throws nullptr_error if the mapped_region is empty.
+                inline std::span<std::byte const> bytes() const {
+                    return std::span<std::byte const>(static_cast<std::byte const*>(get().get()), m_length);
+                }
+                inline explicit operator bool() const noexcept { return notnull_mmap::is_valid(m_addr); }
+                inline bool operator!() const noexcept { return !notnull_mmap::is_valid(m_addr); }
+        };
+    }
+}
+
+#endif //~ HNG_NULLSAFETY_POSIX_HANDLES_HEADERGUARD
@@ -0,0 +1,51 @@
+//
+//	Licence:	MIT
+//	GitHub:		https://github.com/highestnamegames/nullsafety
+//	Version:	v1.0.1
+//
+//	Summary:
+//		C++20 module interface for the nullsafety headers: import hng.nullsafety;
+//		Macros such as HNG_NULLSAFETY_NO_UNIQUE_ADDRESS are not exported by a module; include the header to use them.
+//
+
+module;
+
+// Every standard and system header that the nullsafety headers include must be included here, in the global module fragment,
+// so that the #include directives inside the headers below are skipped by their include guards
+// instead of attaching the standard library to this module.
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __has_include(<sys/mman.h>)
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+export module hng.nullsafety;
+
+#if defined(__clang__)
+// The #include <...> directives inside the headers below are skipped by include guards, see above.
+#pragma clang diagnostic ignored "-Winclude-angled-in-module-purview"
+#endif
+
+// extern "C++" attaches the declarations to the global module, so a program can both #include the headers and import the module.
+export extern "C++" {
+#include "../include/hng/nullsafety/nullsafety.h"
+#include "../include/hng/nullsafety/lazy_notnull.h"
+#if __has_include(<sys/mman.h>)
+#include "../include/hng/nullsafety/posix_handles.h"
+#endif
+}
@@ -1,4 +1,5 @@
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <memory>
@@ -7,7 +8,21 @@
 #include <source_location>
 #include <type_traits>
 #include <concepts>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <atomic>
+#include <thread>
 #include <hng/nullsafety/nullsafety.h>
+#include <hng/nullsafety/lazy_notnull.h>
+#if __has_include(<sys/mman.h>)
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <hng/nullsafety/posix_handles.h>
+#define HNG_NULLSAFETY_TESTS_POSIX 1
+#endif
 
 namespace hng {
     namespace nullsafety_tests {
@@ -21,7 +36,31 @@ namespace hng {
         static_assert(sizeof(hng::nullsafety::derefnullchecked<std::unique_ptr<long, SampleDtor>>) == sizeof(std::unique_ptr<long, SampleDtor>));
         static_assert(alignof(hng::nullsafety::derefnullchecked<std::unique_ptr<long, SampleDtor>>) == alignof(std::unique_ptr<long, SampleDtor>));
 
+        static_assert(!std::is_copy_constructible_v<hng::nullsafety::notnull_box<long>>);
+        static_assert(std::is_nothrow_move_constructible_v<hng::nullsafety::notnull_box<long>>);
+        static_assert(!std::is_constructible_v<hng::nullsafety::notnull_box<long>, std::nullptr_t>);
+
         static constexpr int const static_assertion_variable_x = 5;
+
+        static_assert([]() constexpr {
+            using handle = hng::nullsafety::notnull_handle<int, hng::nullsafety::sentinel_handle_traits<int, -1>>;
+            handle h = 0;
+            return sizeof(handle) == sizeof(int) && h == 0 && handle::is_valid(3) && !handle::is_valid(-1);
+            }());
+
+        static_assert(std::is_empty_v<hng::nullsafety::notnull_constant<&static_assertion_variable_x>>);
+        struct NotNullConstantMember {
+            HNG_NULLSAFETY_NO_UNIQUE_ADDRESS hng::nullsafety::notnull_constant<&static_assertion_variable_x> table;
+            int* p;
+        };
+        static_assert(sizeof(NotNullConstantMember) == sizeof(int*));
+        static_assert(*hng::nullsafety::notnull_constant<&static_assertion_variable_x>{} == 5);
+        static_assert([]() constexpr {
+            hng::nullsafety::notnull_constant<&static_assertion_variable_x> c;
+            hng::nullsafety::notnull<int const*> p = c;
+            hng::nullsafety::derefnullchecked<int const*> q = c;
+            return p == &static_assertion_variable_x && *q == 5 && c.ptr() == c.value;
+            }());
         static_assert([]() constexpr {
             int const* y = &static_assertion_variable_x;
             auto z = hng::nullsafety::notnull<int const*>(y);
@@ -123,6 +162,35 @@ namespace hng {
 
 
 
+        struct NotNullBoxDetail {
+            struct Handler {
+                virtual ~Handler() = default;
+                virtual int handle(int x) const = 0;
+            };
+            struct AddHandler final : Handler {
+                int amount;
+                explicit AddHandler(int amount) noexcept : amount(amount) {}
+                int handle(int x) const override { return x + amount; }
+            };
+            struct TableHandler final : Handler {
+                std::array<int, 64> table{};
+                explicit TableHandler(int fill) noexcept { table.fill(fill); }
+                int handle(int x) const override { return table[static_cast<std::size_t>(x) % table.size()]; }
+            };
+            struct WrapHandler final : Handler {
+                hng::nullsafety::notnull_box<Handler, 64> inner;
+                explicit WrapHandler(hng::nullsafety::notnull_box<Handler, 64>&& inner) noexcept : inner(std::move(inner)) {}
+                int handle(int x) const override { return inner->handle(x) * 10; }
+            };
+            struct CountingHandler final : Handler {
+                int* destroyed;
+                explicit CountingHandler(int* destroyed) noexcept : destroyed(destroyed) {}
+                CountingHandler(CountingHandler&& other) noexcept : destroyed(std::exchange(other.destroyed, nullptr)) {}
+                ~CountingHandler() override { if (destroyed) *destroyed += 1; }
+                int handle(int x) const override { return x; }
+            };
+        };
+
         template<class F>
         bool test(std::string_view name, F&& f, std::source_location location = std::source_location::current()) {
             bool success = false;
@@ -363,6 +431,180 @@ namespace hng {
                     return true;
                 }
                 }); });
+            tests.emplace_back([] { return test("notnull_box stores small objects inline and large objects on the heap", [](auto const& /*test_name*/) {
+                {
+                    using Handler = NotNullBoxDetail::Handler;
+                    hng::nullsafety::notnull_box<Handler> small(std::in_place_type<NotNullBoxDetail::AddHandler>, 2);
+                    hng::nullsafety::notnull_box<Handler> large = NotNullBoxDetail::TableHandler(7);
+                    hng::nullsafety::notnull<Handler*> p = small.as_notnull();
+                    return small.is_inline() && !large.is_inline()
+                        && small->handle(1) == 3 && (*large).handle(5) == 7 && p->handle(2) == 4;
+                }
+                }); });
+            tests.emplace_back([] { return test("notnull_box move", [](auto const& /*test_name*/) {
+                {
+                    using Handler = NotNullBoxDetail::Handler;
+                    int destroyed = 0;
+                    {
+                        auto a = hng::nullsafety::make_notnull_box<Handler, NotNullBoxDetail::CountingHandler>(&destroyed);
+                        auto large = hng::nullsafety::make_notnull_box<Handler, NotNullBoxDetail::TableHandler>(3);
+                        Handler const* largeAddress = large.get();
+                        auto b = std::move(a);
+                        auto c = std::move(large);
+                        if (!a.valueless_after_move() || b.valueless_after_move() || !b.is_inline() || c.get() != largeAddress)
+                            return false;
+                        if (a || !b)
+                            return false;
+                        try {
+                            static_cast<void>(a.as_notnull());
+                            return false;
+                        }
+                        catch (hng::nullsafety::nullptr_error const&) {
+                        }
+                        a = std::move(c);
+                        swap(a, b);
+                        if (b->handle(9) != 3 || a->handle(9) != 9 || destroyed != 0)
+                            return false;
+                    }
+                    return destroyed == 1;
+                }
+                }); });
+            tests.emplace_back([] { return test("notnull_box move assign from an object owned by the box", [](auto const& /*test_name*/) {
+                {
+                    using Handler = NotNullBoxDetail::Handler;
+                    using Box = hng::nullsafety::notnull_box<Handler, 64>;
+                    Box h(std::in_place_type<NotNullBoxDetail::WrapHandler>, Box(std::in_place_type<NotNullBoxDetail::AddHandler>, 2));
+                    Box g(std::in_place_type<NotNullBoxDetail::WrapHandler>, Box(std::in_place_type<NotNullBoxDetail::TableHandler>, 5));
+                    if (h.is_inline() || h->handle(1) != 30 || g->handle(1) != 50)
+                        return false;
+                    h = std::move(static_cast<NotNullBoxDetail::WrapHandler&>(*h).inner);
+                    g = std::move(static_cast<NotNullBoxDetail::WrapHandler&>(*g).inner);
+                    return h.is_inline() && h->handle(1) == 3 && !g.is_inline() && g->handle(1) == 5;
+                }
+                }); });
+            tests.emplace_back([] { return test("lazy_notnull calls the factory once on first access", [](auto const& /*test_name*/) {
+                {
+                    int calls = 0;
+                    hng::nullsafety::lazy_notnull lazy([&calls] { calls += 1; return std::make_shared<int>(8); });
+                    static_assert(std::is_same_v<decltype(lazy.get()), hng::nullsafety::notnull<std::shared_ptr<int>> const&>);
+                    if (lazy.is_initialized() || calls != 0)
+                        return false;
+                    int a = *lazy;
+                    hng::nullsafety::notnull<std::shared_ptr<int>> p = lazy;
+                    return a == 8 && *p == 8 && lazy.get().ptr() == p.ptr() && lazy.is_initialized() && calls == 1;
+                }
+                }); });
+            tests.emplace_back([] { return test("lazy_notnull should throw if the factory returns null and retry on next access", [](auto const& /*test_name*/) {
+                {
+                    static int value = 4;
+                    int calls = 0;
+                    hng::nullsafety::lazy_notnull lazy([&calls] { calls += 1; return calls == 1 ? static_cast<int*>(nullptr) : &value; });
+                    try {
+                        lazy.get();
+                        return false;
+                    }
+                    catch (hng::nullsafety::nullptr_error const&) {
+                    }
+                    if (lazy.is_initialized())
+                        return false;
+                    return *lazy == 4 && lazy.get() == &value && calls == 2;
+                }
+                }); });
+            tests.emplace_back([] { return test("lazy_notnull should throw if the factory function pointer is null", [](auto const& /*test_name*/) {
+                {
+                    using Lazy = hng::nullsafety::lazy_notnull<std::unique_ptr<int>, std::unique_ptr<int>(*)()>;
+                    static_assert(!std::is_default_constructible_v<Lazy>);
+                    Lazy lazy(nullptr);
+                    try {
+                        lazy.get();
+                        return false;
+                    }
+                    catch (hng::nullsafety::nullptr_error const&) {
+                    }
+                    return !lazy.is_initialized();
+                }
+                }); });
+            tests.emplace_back([] { return test("lazy_notnull initializes at most once under contention", [](auto const& /*test_name*/) {
+                {
+                    std::atomic<int> calls = 0;
+                    std::atomic<bool> start = false;
+                    hng::nullsafety::lazy_notnull lazy([&calls] { calls.fetch_add(1); return std::make_unique<int>(1); });
+                    std::array<int const*, 8> seen{};
+                    std::vector<std::thread> threads;
+                    for (std::size_t i = 0; i < seen.size(); ++i) {
+                        threads.emplace_back([&, i] {
+                            while (!start.load()) {}
+                            seen[i] = lazy.get().ptr().get();
+                            });
+                    }
+                    start.store(true);
+                    for (auto& thread : threads) thread.join();
+                    return calls.load() == 1 && std::all_of(seen.begin(), seen.end(), [&](int const* p) { return p == seen[0] && *p == 1; });
+                }
+                }); });
+            tests.emplace_back([] { return test("notnull_handle should throw if constructed from the sentinel value at runtime", [](auto const& /*test_name*/) {
+                {
+                    using handle = hng::nullsafety::notnull_handle<int, hng::nullsafety::sentinel_handle_traits<int, -1>>;
+                    handle h(0);
+                    try {
+                        handle g(-1);
+                        return false;
+                    }
+                    catch (hng::nullsafety::nullptr_error const&) {
+                    }
+                    try {
+                        h = -1;
+                        return false;
+                    }
+                    catch (hng::nullsafety::nullptr_error const&) {
+                    }
+                    return h == 0;
+                }
+                }); });
+#if HNG_NULLSAFETY_TESTS_POSIX
+            tests.emplace_back([] { return test("unique_fd and mapped_region over a temporary file", [](auto const& /*test_name*/) {
+                {
+                    std::string path = (std::filesystem::temp_directory_path() / "hng_nullsafety_XXXXXX").string();
+                    hng::nullsafety::unique_fd fd(hng::nullsafety::notnull_fd(::mkstemp(path.data())));
+                    ::unlink(path.c_str());
+                    char const text[] = "zero-copy";
+                    if (::write(fd.get(), text, sizeof(text)) != static_cast<ssize_t>(sizeof(text)))
+                        return false;
+
+                    auto region = hng::nullsafety::mapped_region::map(fd.get(), sizeof(text));
+                    std::span<std::byte const> bytes = std::as_const(region).bytes();
+                    if (bytes.size() != sizeof(text) || std::memcmp(bytes.data(), text, sizeof(text)) != 0)
+                        return false;
+
+                    auto moved = std::move(region);
+                    try {
+                        static_cast<void>(region.bytes());
+                        return false;
+                    }
+                    catch (hng::nullsafety::nullptr_error const&) {
+                    }
+                    if (!static_cast<bool>(moved) || region || moved.bytes().data() != bytes.data())
+                        return false;
+
+                    auto writable = hng::nullsafety::mapped_region::map(fd.get(), sizeof(text), PROT_READ | PROT_WRITE);
+                    std::span<std::byte> out = writable.bytes();
+                    out[0] = std::byte{ 'Z' };
+                    char first = 0;
+                    return ::pread(fd.get(), &first, 1, 0) == 1 && first == 'Z';
+                }
+                }); });
+            tests.emplace_back([] { return test("unique_fd open should throw system_error for a missing file", [](auto const& /*test_name*/) {
+                {
+                    try {
+                        auto fd = hng::nullsafety::unique_fd::open("/nonexistent/hng_nullsafety", O_RDONLY);
+                        return false;
+                    }
+                    catch (std::system_error const& ex) {
+                        return ex.code() == std::errc::no_such_file_or_directory;
+                    }
+                }
+                }); });
+#endif
             tests.emplace_back([] { return test("readme example", [](auto const& /*test_name*/) {
                 {
                     int x = 2;